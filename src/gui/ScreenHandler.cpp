@@ -108,6 +108,7 @@ void Screens::Draw() {
     if (current == nullptr) {
         return;
     }
+    window_t::UpdateCapturedWindowSnapshot(); // capture cannot change mid-paint, resolve it once for all widgets
     current->Draw();
 }
 
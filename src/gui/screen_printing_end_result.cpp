@@ -11,6 +11,7 @@ namespace {
 constexpr const char *txt_print_started { N_("Print started") };
 constexpr const char *txt_print_ended { N_("Print ended") };
 constexpr const char *txt_consumed_material { N_("Consumed material") };
+constexpr const char *txt_no_consumed_material { "---" }; // placeholder, deliberately not translated
 #if PRINTER_IS_PRUSA_XL
 constexpr const char *txt_wipe_tower_pretranslated { N_("Prime tower %dg") };
 #else
@@ -54,7 +55,7 @@ constexpr size_t middle_of_buttons { 185 + 40 };
 constexpr auto arrow_right_res { &img::arrow_right_10x16 };
 constexpr Rect16 arrow_right_rect { column_right + column_width, middle_of_buttons - arrow_right_res->h / 2, arrow_right_res->w, arrow_right_res->h };
 
-void handle_timestamp_text_item(MarlinVariableLocked<time_t> &time_holder, EndResultBody::DateBufferT &buffer, window_text_t &text_value) {
+void handle_timestamp_text_item(MarlinVariableLocked<time_t> &time_holder, std::span<char> buffer, window_text_t &text_value) {
     const auto time_format = time_tools::get_time_format();
     struct tm print_tm;
     time_holder.execute_with([&](const time_t &print_time) {
@@ -116,12 +117,6 @@ EndResultBody::EndResultBody(window_t *parent, Rect16 rect)
     progress_txt.set_font(progress_font);
 }
 
-Rect16 EndResultBody::get_progress_txt_rect(int16_t row_0) {
-    static constexpr size_t progress_top_decrease { 4 };
-    static_assert(progress_top_decrease <= extra_top_space); // otherwise try increasing extra top space
-    return { 300, static_cast<int16_t>(get_row(row_0, 0) - progress_top_decrease), 135, 54 };
-}
-
 int16_t EndResultBody::get_row_0() const {
     return GetRect().Top() + extra_top_space;
 }
@@ -130,17 +125,17 @@ void EndResultBody::Show() {
 
     auto &gcode { GCodeInfo::getInstance() };
 
-    PrintTime::print_formatted_duration(marlin_vars()->print_duration.get(), { printing_time_value_buffer }, true);
+    PrintTime::print_formatted_duration(marlin_vars()->print_duration.get(), printing_time_buffer(), true);
 
     printing_time_label.Show();
     printing_time_value.Show();
-    printing_time_value.SetText(_(printing_time_value_buffer.data()));
+    printing_time_value.SetText(_(printing_time_buffer().data()));
 
     print_started_label.Show();
     print_ended_label.Show();
 
-    handle_timestamp_text_item(marlin_vars()->print_start_time, print_started_value_buffer, print_started_value);
-    handle_timestamp_text_item(marlin_vars()->print_end_time, print_ended_value_buffer, print_ended_value);
+    handle_timestamp_text_item(marlin_vars()->print_start_time, print_started_buffer(), print_started_value);
+    handle_timestamp_text_item(marlin_vars()->print_end_time, print_ended_buffer(), print_ended_value);
 
     handle_consumed_material_showing(gcode);
 
@@ -170,9 +165,8 @@ void EndResultBody::handle_consumed_material_showing(const GCodeInfo &gcode) {
 
     consumed_material_label.Show();
     if (num_extruders_with_valid_grams == 0 && !has_valid_wipe_tower_grams) {
-        auto &buff { consumed_material_values_buffers[0] };
-        snprintf(buff.data(), buff.size(), "---");
-        consumed_material_values[0].SetText(_(buff.data()));
+        // static placeholder, point the widget at flash instead of formatting into the arena
+        consumed_material_values[0].SetText(string_view_utf8::MakeCPUFLASH((const uint8_t *)txt_no_consumed_material));
         consumed_material_values[0].Show();
     } else {
         handle_consumed_tool_fields(gcode, num_extruders_with_valid_grams);
@@ -185,10 +179,10 @@ void EndResultBody::handle_wipe_tower_showing([[maybe_unused]] const GCodeInfo &
     // wipe tower
     if (has_valid_wipe_tower_grams) {
 
-        auto &buff { consumed_wipe_tower_value_buffer };
+        auto buff { wipe_tower_buffer() };
         const auto used_g = static_cast<int>(std::lround(gcode.get_filament_wipe_tower_g().value()));
 
-        char translated_fmt[std::tuple_size_v<decltype(consumed_wipe_tower_value_buffer)>];
+        char translated_fmt[wipe_tower_buffer_size];
         _(txt_wipe_tower_pretranslated).copyToRAM(translated_fmt, sizeof(translated_fmt));
         snprintf(buff.data(), buff.size(), translated_fmt, used_g);
 
@@ -214,7 +208,7 @@ void EndResultBody::handle_consumed_tool_fields(const GCodeInfo &gcode, size_t n
                 return fname.has_value() ? fname.value().data() : "---";
             };
 
-            auto &buff { consumed_material_values_buffers[consumed_material_line_idx] };
+            auto buff { consumed_material_buffer(consumed_material_line_idx) };
 
             const bool show_t_label {
 #if EXTRUDERS > 1
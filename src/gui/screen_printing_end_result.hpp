@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include <window.hpp>
 #include <window_text.hpp>
 #include <window_icon.hpp>
@@ -39,7 +41,12 @@ public:
     static constexpr auto progress_alignment { Align_t::RightTop() };
     static constexpr int16_t extra_top_space { 6 }; // required extra top space to properly offset progress_txt, otherwise if just setting progress txt rect top to be 'above' what this frame holds, it will just not draw at all
 
-    static Rect16 get_progress_txt_rect(int16_t row_0);
+    // constexpr so the rect folds to a constant wherever row_0 is known at compile time
+    static constexpr Rect16 get_progress_txt_rect(int16_t row_0) {
+        constexpr int16_t progress_top_decrease { 4 };
+        static_assert(progress_top_decrease <= extra_top_space); // otherwise try increasing extra top space
+        return { 300, static_cast<int16_t>(row_0 - progress_top_decrease), 135, 54 };
+    }
 
 protected:
     void windowEvent(window_t *sender, GUI_event_t event, void *param) override;
@@ -58,25 +65,43 @@ private:
 
     static constexpr long minimum_grams_valid = 1;
 
+    // per-slot sizes and offsets into the shared text arena, computed at compile time
+    static constexpr size_t printing_time_buffer_size { sizeof("100d 20h 30m") + extra_buffer_size };
+    static constexpr size_t date_buffer_size { std::tuple_size_v<DateBufferT> };
+    static constexpr size_t consumed_material_buffer_size { sizeof("T1 HIFIPETG 10.000g") + extra_buffer_size };
+    static constexpr size_t wipe_tower_buffer_size { sizeof("Wipe Tower 10.000g") + extra_buffer_size };
+
+    static constexpr size_t printing_time_buffer_offset { 0 };
+    static constexpr size_t print_started_buffer_offset { printing_time_buffer_offset + printing_time_buffer_size };
+    static constexpr size_t print_ended_buffer_offset { print_started_buffer_offset + date_buffer_size };
+    static constexpr size_t consumed_material_buffers_offset { print_ended_buffer_offset + date_buffer_size };
+    static constexpr size_t wipe_tower_buffer_offset { consumed_material_buffers_offset + EXTRUDERS * consumed_material_buffer_size };
+    static constexpr size_t text_arena_size { wipe_tower_buffer_offset + wipe_tower_buffer_size };
+
+    std::span<char> printing_time_buffer() { return { text_arena.data() + printing_time_buffer_offset, printing_time_buffer_size }; }
+    std::span<char> print_started_buffer() { return { text_arena.data() + print_started_buffer_offset, date_buffer_size }; }
+    std::span<char> print_ended_buffer() { return { text_arena.data() + print_ended_buffer_offset, date_buffer_size }; }
+    std::span<char> consumed_material_buffer(size_t idx) { return { text_arena.data() + consumed_material_buffers_offset + idx * consumed_material_buffer_size, consumed_material_buffer_size }; }
+    std::span<char> wipe_tower_buffer() { return { text_arena.data() + wipe_tower_buffer_offset, wipe_tower_buffer_size }; }
+
+    // widgets are kept together so the paint/event walk touches a compact block,
+    // all text buffers live in the single arena below
     window_text_t printing_time_label;
     window_text_t printing_time_value;
-    std::array<char, sizeof("100d 20h 30m") + extra_buffer_size> printing_time_value_buffer;
 
     window_text_t print_started_label;
     window_text_t print_started_value;
-    DateBufferT print_started_value_buffer;
 
     window_text_t print_ended_label;
     window_text_t print_ended_value;
-    DateBufferT print_ended_value_buffer;
 
     window_text_t consumed_material_label;
     std::array<window_text_t, EXTRUDERS> consumed_material_values;
-    std::array<std::array<char, sizeof("T1 HIFIPETG 10.000g") + extra_buffer_size>, EXTRUDERS> consumed_material_values_buffers;
 
     window_text_t consumed_wipe_tower_value;
-    std::array<char, sizeof("Wipe Tower 10.000g") + extra_buffer_size> consumed_wipe_tower_value_buffer;
 
     window_icon_t arrow_right;
     WindowNumbPrintProgress progress_txt;
+
+    std::array<char, text_arena_size> text_arena;
 };
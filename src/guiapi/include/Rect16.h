@@ -397,9 +397,19 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     /// @brief Determines if the given rectangle has intersection with the current
     /// one
+    /// @details Deliberately branchless (bitwise & over the axis comparisons),
+    /// it runs for every Invalidate/Validate call and the branches were
+    /// unpredictable under mixed widget sets. Empty rects never intersect, the
+    /// width/height tests fold into the same mask.
     /// @param[in] rect Rectangle given to check
     /// @return Return true if the rectangles has intersection, false otherwise.
-    bool HasIntersection(Rect16 const &) const;
+    constexpr bool HasIntersection(Rect16 const &r) const {
+        return bool(width_) & bool(height_) & bool(r.width_) & bool(r.height_)
+            & (TopLeft().x < r.EndPoint().x)
+            & (EndPoint().x > r.TopLeft().x)
+            & (TopLeft().y < r.EndPoint().y)
+            & (EndPoint().y > r.TopLeft().y);
+    }
 
     ////////////////////////////////////////////////////////////////////////////
     /// @brief Determines if the given rectangle is fully overlayed by the
@@ -7,4 +7,13 @@
 
 #pragma once
 
-void gui_invalidate();
+#include <atomic>
+
+/// pending-redraw flag, set by every window invalidation and consumed once per
+/// gui_redraw tick; inline so the hot Invalidate path is a single relaxed store
+/// instead of a cross-module call
+inline std::atomic<bool> gui_invalidation_pending { false };
+
+inline void gui_invalidate() {
+    gui_invalidation_pending.store(true, std::memory_order_relaxed);
+}
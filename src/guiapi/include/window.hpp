@@ -13,24 +13,38 @@
 
 class window_t {
     Rect16 rect; // (8 bytes) display rectangle
+    Rect16 invalid_rect; // dirty sub-region accumulator, empty == entire window is dirty
     CompactRAMPointer<window_t> parent;
     CompactRAMPointer<window_t> next;
 
+    // ancestor bloom filter: OR of self_bit of every window on the parent chain
+    // collisions can cause false positives, never false negatives, so IsChildOf
+    // can reject without walking and only confirms positive hits
+    uint16_t ancestor_bits = 0;
+    uint16_t self_bit = uint16_t(1u << ((reinterpret_cast<uintptr_t>(this) >> 2) & 15));
+
+    // memoized GetRect() result, resolving the parent transform chain on every
+    // call was O(tree depth) and GetRect is called several times per draw
+    mutable Rect16 cached_absolute_rect;
+    mutable bool rect_cache_valid = false;
+
 protected:
     WindowFlags flags;
 
 private:
-    // depends on color_scheme_background flag
-    // if enabled and set != nullptr
-    //   window automatically draws differently when selected or shadowed
-    union {
-        color_t color_back = GuiDefaults::ColorBack;
-        const color_scheme *pBackColorScheme;
-    };
+    // flat color or color_scheme pointer in one tagged word
+    // low bit set = color shifted up by one (top color byte is unused)
+    // low bit clear = pointer to scheme, window automatically draws differently
+    //   when selected or shadowed
+    // flags.color_scheme_background mirrors the tag for subclasses, GetBackColor
+    // itself only tests the tag - one load + one branch on the paint path
+    static constexpr uintptr_t tagged_color(color_t clr) { return (uintptr_t(clr) << 1) | 1; }
+    uintptr_t back_state = tagged_color(GuiDefaults::ColorBack);
 
 public:
     Rect16 GetRect() const;
     Rect16 GetRectWithoutTransformation() const;
+    Rect16 GetInvalidationRect() const; // part of the window that needs redrawing, GetRect() when everything is dirty
 
     void SetRect(Rect16 rc); // does not transform
     void SetRectWithoutTransformation(Rect16 rc);
@@ -74,8 +88,11 @@ public:
 
     bool IsInvalid() const;
     bool HasValidBackground() const;
-    bool IsFocused() const;
-    bool IsCaptured() const;
+    // hit by every widget redraw (color selection), must stay a load + compare
+    inline bool IsFocused() const { return focused_ptr == this; }
+    // compares against the snapshot taken at the top of Screens::Draw, capture
+    // cannot change mid-paint and resolving it walks the screen's dialog chain
+    inline bool IsCaptured() const { return captured_snapshot == this; }
     bool IsCapturable() const;
     bool HasEnforcedCapture() const;
     bool HasTimer() const;
@@ -127,7 +144,10 @@ public:
     void SetBackColor(color_t clr);
     void SetBackColor(const color_scheme &clr);
     color_t GetBackColor() const;
-    void SetRelativeSubwins() { flags.has_relative_subwins = true; }
+    void SetRelativeSubwins() {
+        flags.has_relative_subwins = true;
+        InvalidateRectCache(); // changes how children rects resolve
+    }
     void SetRoundCorners() { flags.has_round_corners = true; }
     void SetHasIcon();
     void ClrHasIcon();
@@ -146,6 +166,8 @@ public:
     void ShiftNextTo(ShiftDir_t direction);
     virtual void Shift(ShiftDir_t direction, uint16_t distance);
     virtual void ChildVisibilityChanged(window_t &child);
+    virtual void UpdateAncestorBloom(); // refresh ancestor_bits after reparenting, frame resends to children
+    virtual void InvalidateRectCache(); // drop memoized absolute rect after move/reparenting, frame resends to children
 
     enum class ChildDialogParam : uint8_t {
         first_dialog,
@@ -186,11 +208,13 @@ protected:
     virtual void invalidate(Rect16 validation_rect);
     virtual void validate(Rect16 validation_rect); // do not use, used by screen
     static window_t *focused_ptr; // has focus
+    static window_t *captured_snapshot; // captured window resolved once per paint walk
 
 public:
     virtual window_t *GetCapturedWindow();
-    static window_t *GetFocusedWindow();
-    static void ResetFocusedWindow();
+    static window_t *GetFocusedWindow() { return focused_ptr; }
+    static void ResetFocusedWindow() { focused_ptr = nullptr; }
+    static void UpdateCapturedWindowSnapshot(); // must be called before a paint walk, IsCaptured compares against the snapshot
 };
 
 /*****************************************************************************/
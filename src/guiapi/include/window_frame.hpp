@@ -65,6 +65,8 @@ public:
     Rect16 GenerateRect(Rect16::Height_t height, uint16_t distance = 0);
     virtual void Shift(ShiftDir_t direction, uint16_t distance) override;
     virtual void ChildVisibilityChanged(window_t &child) override;
+    virtual void UpdateAncestorBloom() override;
+    virtual void InvalidateRectCache() override;
 
 protected:
     virtual void draw() override;
@@ -45,6 +45,18 @@ enum class win_type_t : uint8_t {
 
 // todo add can capture flag (needed in frame event and SetCapture)
 union WindowFlags {
+    // explicit masks into data for the hot flags, numbers must match the bit
+    // position comments in the struct below
+    // combined predicates (visible && !hidden_behind_dialog etc.) compile to a
+    // single load + mask + compare instead of one bitfield extract per flag
+    enum : uint32_t {
+        mask_visible = 1u << 0x02,
+        mask_enabled = 1u << 0x03,
+        mask_invalid = 1u << 0x04,
+        mask_hidden_behind_dialog = 1u << 0x0A,
+        mask_enforce_capture_when_not_visible = 1u << 0x0E,
+    };
+
     uint32_t data;
     struct {
         win_type_t type : 2 = win_type_t::normal; // 00 .. 01 - type of window
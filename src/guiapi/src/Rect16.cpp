@@ -148,16 +148,6 @@ Rect16 &Rect16::operator+=(Rect16 rhs) {
     return *this;
 }
 
-bool Rect16::HasIntersection(Rect16 const &r) const {
-    if (IsEmpty() || r.IsEmpty()) {
-        return false;
-    }
-    return TopLeft().x < r.EndPoint().x
-        && EndPoint().x > r.TopLeft().x
-        && TopLeft().y < r.EndPoint().y
-        && EndPoint().y > r.TopLeft().y;
-}
-
 bool Rect16::Contain(Rect16 const &r) const {
     if (r.IsEmpty()) {
         return true;
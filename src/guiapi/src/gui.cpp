@@ -31,8 +31,6 @@
 LOG_COMPONENT_REF(GUI);
 LOG_COMPONENT_REF(Touch);
 
-static bool gui_invalid = false;
-
 constexpr padding_ui8_t GuiDefaults::Padding;
 constexpr Rect16 GuiDefaults::RectHeader;
 constexpr Rect16 GuiDefaults::RectScreenBody;
@@ -120,10 +118,11 @@ void gui_handle_touch() {
 void gui_redraw(void) {
     uint32_t now = ticks_ms();
     bool should_sleep = true;
-    if (gui_invalid) {
+    if (gui_invalidation_pending.load(std::memory_order_relaxed)) {
         if (gui_redraw_timer.RestartIfIsOver(now)) {
+            // clear before drawing, invalidations raised during the draw must not be lost
+            gui_invalidation_pending.store(false, std::memory_order_relaxed);
             Screens::Access()->Draw();
-            gui_invalid = false;
             should_sleep = false;
         }
     }
@@ -134,11 +133,6 @@ void gui_redraw(void) {
     }
 }
 
-// at least one window is invalid
-void gui_invalidate(void) {
-    gui_invalid = true;
-}
-
 static uint8_t guiloop_nesting = 0;
 uint8_t gui_get_nesting(void) { return guiloop_nesting; }
 
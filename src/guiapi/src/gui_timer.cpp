@@ -83,6 +83,9 @@ void gui_timer_delete(int8_t id) {
 
 void gui_timers_delete_by_window(window_t *pWin) {
     int8_t id;
+    if (gui_timer_count <= 0) {
+        return; // no live timer, common case for widget teardown (also skips the pool before its first memset)
+    }
     for (id = 0; id < GUI_MAX_TIMERS; id++) {
         if (gui_timers[id].pWin == pWin) {
             gui_timer_delete(id);
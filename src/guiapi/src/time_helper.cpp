@@ -1,27 +1,93 @@
 #include "time_helper.hpp"
-#include <ctime>
+#include <array>
+#include <cassert>
+
+namespace {
+
+// two-digit lookup table, emitting digits in pairs halves the divmod count
+constexpr auto digit_pairs = []() {
+    std::array<char, 200> lut {};
+    for (int i = 0; i < 100; ++i) {
+        lut[2 * i] = char('0' + i / 10);
+        lut[2 * i + 1] = char('0' + i % 10);
+    }
+    return lut;
+}();
+
+// emits decimal n, returns pointer past the last digit
+char *put_unsigned(char *out, std::uint32_t n) {
+    char tmp[10];
+    char *const end = tmp + sizeof(tmp);
+    char *p = end;
+    while (n >= 100) {
+        const std::uint32_t rest = n / 100; // constant divisor, compiles to a multiply
+        const std::uint32_t pair = n - rest * 100;
+        *--p = digit_pairs[2 * pair + 1];
+        *--p = digit_pairs[2 * pair];
+        n = rest;
+    }
+    if (n >= 10) {
+        *--p = digit_pairs[2 * n + 1];
+        *--p = digit_pairs[2 * n];
+    } else {
+        *--p = char('0' + n);
+    }
+    while (p != end) {
+        *out++ = *p++;
+    }
+    return out;
+}
+
+// emits n right-aligned to width 2 with a leading space, matches snprintf "%2i"
+char *put_unsigned_pad2(char *out, std::uint32_t n) {
+    if (n < 10) {
+        *out++ = ' ';
+        *out++ = char('0' + n);
+        return out;
+    }
+    return put_unsigned(out, n);
+}
+
+} // namespace
 
 void format_duration(std::span<char> buffer, std::uint32_t duration, bool display_seconds) {
-    static constexpr std::uint32_t SECONDS_PER_DAY = 24 * 60 * 60;
-    time_t time = (time_t)duration;
+    // runs every second of a print, decompose the duration directly instead of
+    // going through gmtime + snprintf (which issues library divisions per field)
+    const std::uint32_t minutes_total = duration / 60;
+    const std::uint32_t seconds = duration - minutes_total * 60;
+    const std::uint32_t hours_total = minutes_total / 60;
+    const std::uint32_t minutes = minutes_total - hours_total * 60;
+    const std::uint32_t days = hours_total / 24;
+    const std::uint32_t hours = hours_total - days * 24;
 
-    const struct tm *timeinfo = gmtime(&time);
-    [[maybe_unused]] int count = 0;
-    if (timeinfo->tm_yday) {
-        // days are recalculated, because timeinfo shows number of days in year and we want more days than 365
-        uint16_t days = duration / SECONDS_PER_DAY;
-        count = snprintf(buffer.data(), buffer.size(), "%ud %uh", days, timeinfo->tm_hour);
-    } else if (timeinfo->tm_hour) {
-        count = snprintf(buffer.data(), buffer.size(), "%ih %2im", timeinfo->tm_hour, timeinfo->tm_min);
+    char *p = buffer.data();
+    if (days) {
+        p = put_unsigned(p, days);
+        *p++ = 'd';
+        *p++ = ' ';
+        p = put_unsigned(p, hours);
+        *p++ = 'h';
+    } else if (hours) {
+        p = put_unsigned(p, hours);
+        *p++ = 'h';
+        *p++ = ' ';
+        p = put_unsigned_pad2(p, minutes);
+        *p++ = 'm';
     } else if (display_seconds) {
-        if (timeinfo->tm_min) {
-            count = snprintf(buffer.data(), buffer.size(), "%im %2is", timeinfo->tm_min, timeinfo->tm_sec);
+        if (minutes) {
+            p = put_unsigned(p, minutes);
+            *p++ = 'm';
+            *p++ = ' ';
+            p = put_unsigned_pad2(p, seconds);
+            *p++ = 's';
         } else {
-            count = snprintf(buffer.data(), buffer.size(), "%is", timeinfo->tm_sec);
+            p = put_unsigned(p, seconds);
+            *p++ = 's';
         }
     } else {
-        count = snprintf(buffer.data(), buffer.size(), "%im", timeinfo->tm_min);
+        p = put_unsigned(p, minutes);
+        *p++ = 'm';
     }
-    assert(count > 0);
-    assert(static_cast<std::uint32_t>(count) < buffer.size());
+    *p = '\0';
+    assert(static_cast<std::uint32_t>(p - buffer.data()) < buffer.size());
 }
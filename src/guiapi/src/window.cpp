@@ -9,18 +9,21 @@
 #include "marlin_client.hpp"
 #include "knob_event.hpp"
 
-bool window_t::IsVisible() const { return flags.visible && !flags.hidden_behind_dialog; }
+bool window_t::IsVisible() const { return (flags.data & (WindowFlags::mask_visible | WindowFlags::mask_hidden_behind_dialog)) == WindowFlags::mask_visible; }
 bool window_t::HasVisibleFlag() const { return flags.visible; };
 bool window_t::IsHiddenBehindDialog() const { return flags.hidden_behind_dialog; }
 bool window_t::IsInvalid() const { return flags.invalid; }
-bool window_t::IsFocused() const { return GetFocusedWindow() == this; }
 bool window_t::HasTimer() const { return flags.timer; }
 win_type_t window_t::GetType() const { return win_type_t(flags.type); }
 bool window_t::IsDialog() const { return GetType() == win_type_t::dialog; }
 bool window_t::ClosedOnTimeout() const { return flags.timeout_close == is_closed_on_timeout_t::yes; }
 bool window_t::ClosedOnPrint() const { return flags.print_close == is_closed_on_printing_t::yes; }
 bool window_t::HasEnforcedCapture() const { return flags.enforce_capture_when_not_visible; }
-bool window_t::IsCapturable() const { return IsVisible() || HasEnforcedCapture(); }
+bool window_t::IsCapturable() const {
+    const uint32_t bits = flags.data; // single load for all three flags
+    return (bits & WindowFlags::mask_enforce_capture_when_not_visible)
+        || (bits & (WindowFlags::mask_visible | WindowFlags::mask_hidden_behind_dialog)) == WindowFlags::mask_visible;
+}
 bool window_t::HasIcon() const { return flags.has_icon; }
 
 void window_t::SetHasIcon() {
@@ -69,6 +72,7 @@ void window_t::Validate(Rect16 validation_rect) {
     if (validation_rect.IsEmpty() || rect.HasIntersection(validation_rect)) {
         flags.invalid = false;
         flags.invalid_background = false;
+        invalid_rect = Rect16();
         validate(validation_rect);
     }
 }
@@ -84,7 +88,20 @@ void window_t::Invalidate(Rect16 invalidation_rect) {
 }
 
 // frame will invalidate children
-void window_t::invalidate([[maybe_unused]] Rect16 validation_rect) {
+void window_t::invalidate(Rect16 invalidation_rect) {
+    // already fully dirty (incl. background) - writing the flags again would be a no-op
+    // background must be checked, IRadioButton re-validates it after Invalidate
+    if (flags.invalid && flags.invalid_background && invalid_rect.IsEmpty()) {
+        return;
+    }
+    // coalesce dirty sub-regions, empty invalid_rect means the entire window is dirty
+    if (invalidation_rect.IsEmpty()) {
+        invalid_rect = Rect16();
+    } else if (!flags.invalid) {
+        invalid_rect = invalidation_rect.Intersection(rect);
+    } else if (!invalid_rect.IsEmpty()) {
+        invalid_rect += invalidation_rect.Intersection(rect);
+    }
     flags.invalid = true;
     flags.invalid_background = true;
 }
@@ -111,7 +128,9 @@ bool window_t::HasValidBackground() const {
 // popup does not claim capture, but can hide window
 // At this point we are sure no dialog has capture, so we check only visible flag
 window_t *window_t::GetCapturedWindow() {
-    return HasVisibleFlag() ? this : nullptr;
+    // branchless select: the visible flag becomes an all-ones/all-zeros mask,
+    // avoids a data-dependent branch on the per-input-event capture walk
+    return reinterpret_cast<window_t *>(reinterpret_cast<uintptr_t>(this) & -uintptr_t(HasVisibleFlag()));
 }
 
 void window_t::SetHasTimer() { flags.timer = true; }
@@ -195,26 +214,27 @@ void window_t::set_shadow(bool set) {
 }
 
 color_t window_t::GetBackColor() const {
-    if (flags.color_scheme_background && pBackColorScheme) {
-        return pBackColorScheme->Get(IsFocused(), IsShadowed());
+    if (back_state & 1) {
+        return color_t(back_state >> 1);
     }
-    return color_back;
+    return reinterpret_cast<const color_scheme *>(back_state)->Get(IsFocused(), IsShadowed());
 }
 
 void window_t::SetBackColor(color_t clr) {
-    if (flags.color_scheme_background || color_back != clr) {
-        color_back = clr;
+    const uintptr_t new_state = tagged_color(clr);
+    if (back_state != new_state) {
+        back_state = new_state;
         flags.color_scheme_background = false;
         Invalidate();
     }
 }
 
 void window_t::SetBackColor(const color_scheme &clr) {
-    if ((!flags.color_scheme_background) || (!pBackColorScheme) || ((*pBackColorScheme) != clr)) {
+    if ((back_state & 1) || ((*reinterpret_cast<const color_scheme *>(back_state)) != clr)) {
         flags.color_scheme_background = true;
         Invalidate();
     }
-    pBackColorScheme = &clr; // rewrite even when value is same, because address might be different
+    back_state = reinterpret_cast<uintptr_t>(&clr); // rewrite even when value is same, because address might be different
 }
 
 window_t::window_t(window_t *parent, Rect16 rect, win_type_t type, is_closed_on_click_t close)
@@ -223,6 +243,7 @@ window_t::window_t(window_t *parent, Rect16 rect, win_type_t type, is_closed_on_
     flags.type = type;
     flags.close_on_click = close;
     flags.enabled = (close == is_closed_on_click_t::yes);
+    UpdateAncestorBloom(); // virtual resolves to base here, there are no children yet
     Invalidate();
     if (parent) {
         parent->RegisterSubWin(*this);
@@ -247,28 +268,72 @@ window_t::~window_t() {
 }
 
 Rect16 window_t::GetRect() const {
-    if (GetParent()) {
-        return GetParent()->TransformRect(rect); // do not use GetRect() - would be recursive
+    if (rect_cache_valid) {
+        return cached_absolute_rect;
+    }
+
+    // flatten the uncached tail of the parent chain and resolve it top-down,
+    // the recursive GetRect <-> TransformRect round trip cost a call frame and
+    // redundant transform math per ancestor
+    // cache is dropped whenever a window or any ancestor moves or reparents
+    // (InvalidateRectCache), so warm calls return above without any walk
+    static constexpr size_t max_chain = 8;
+    const window_t *chain[max_chain];
+    size_t depth = 0;
+    const window_t *ancestor = this;
+    while (ancestor && !ancestor->rect_cache_valid && depth < max_chain) {
+        chain[depth++] = ancestor;
+        ancestor = ancestor->GetParent();
+    }
+    if (ancestor && !ancestor->rect_cache_valid) {
+        ancestor->GetRect(); // tree deeper than max_chain, resolve the rest re-entrantly
+    }
+
+    // ancestor is now the nearest cached ancestor (or null at the root)
+    while (depth > 0) {
+        const window_t *win = chain[--depth];
+        Rect16 abs_rect = win->rect;
+        if (ancestor) {
+            if (ancestor->flags.has_relative_subwins) {
+                abs_rect.Transform(ancestor->cached_absolute_rect);
+            } else {
+                abs_rect = abs_rect.Intersection(ancestor->cached_absolute_rect);
+            }
+        }
+        win->cached_absolute_rect = abs_rect;
+        win->rect_cache_valid = true;
+        ancestor = win;
     }
+    return cached_absolute_rect;
+}
 
-    return rect;
+void window_t::InvalidateRectCache() {
+    rect_cache_valid = false;
 }
 
 Rect16 window_t::GetRectWithoutTransformation() const {
     return rect;
 }
 
+Rect16 window_t::GetInvalidationRect() const {
+    if (invalid_rect.IsEmpty()) {
+        return GetRect();
+    }
+    return GetRect().Intersection(invalid_rect);
+}
+
 void window_t::SetRect(Rect16 rc) {
     if (GetParent()) {
         rect = GetParent()->TransformRect(rc); // do not use SetRect() - would be recursive
-        return;
+    } else {
+        rect = rc;
     }
-
-    rect = rc;
+    InvalidateRectCache();
 }
 
 void window_t::SetRectWithoutTransformation(Rect16 rc) {
     rect = rc;
+    InvalidateRectCache();
 }
 
 // TransformRect calls GetRect which calls TransformRect on parrent level ...
@@ -315,6 +380,13 @@ void window_t::SetPrev(window_t *prv) {
 
 void window_t::SetParent(window_t *par) {
     parent = par;
+    UpdateAncestorBloom();
+    InvalidateRectCache();
+}
+
+void window_t::UpdateAncestorBloom() {
+    const window_t *par = GetParent();
+    ancestor_bits = par ? uint16_t(par->ancestor_bits | par->self_bit) : uint16_t(0);
 }
 
 window_t *window_t::GetNext() const {
@@ -328,8 +400,10 @@ window_t *window_t::GetPrev() const {
 */
 
 window_t *window_t::GetNextEnabled() const {
-    if (next) {
-        return (next->IsEnabled()) ? next.ptr() : next->GetNextEnabled();
+    for (window_t *win = next; win; win = win->GetNext()) {
+        if (win->IsEnabled()) {
+            return win;
+        }
     }
     return nullptr;
 }
@@ -349,6 +423,11 @@ window_t *window_t::GetParent() const {
 }
 
 bool window_t::IsChildOf(window_t *win) const {
+    // bloom miss proves win is not an ancestor, only hits need the walk
+    if (!win || (ancestor_bits & win->self_bit) == 0) {
+        return false;
+    }
+
     window_t *par = GetParent();
     while (par) {
         if (par == win) {
@@ -403,19 +482,25 @@ bool window_t::registerSubWin([[maybe_unused]] window_t &win) {
 void window_t::unregisterSubWin([[maybe_unused]] window_t &win) {
 }
 
-// cannot add rect, it is stored in frame, so must incalidate entire window
-void window_t::addInvalidationRect([[maybe_unused]] Rect16 rc) {
+// store the rect in the dirty accumulator, redraw repaints only its union
+void window_t::addInvalidationRect(Rect16 rc) {
     if (!rect.IsEmpty()) {
-        Invalidate();
+        Invalidate(rc);
     }
 }
 
 void window_t::unconditionalDraw() {
     if (flags.has_round_corners) {
+        // corner geometry depends on the full rect, cannot present partially
         color_t parent_back_color = GetParent() ? GetParent()->GetBackColor() : GetBackColor();
         display::DrawRoundedRect(GetRect(), parent_back_color, GetBackColor(), GuiDefaults::DefaultCornerRadius, MIC_ALL_CORNERS);
     } else {
-        display::FillRect(GetRect(), GetBackColor());
+        // partial present: push only the dirty part to the display bus,
+        // whole rect when everything is dirty
+        const Rect16 dirty = GetInvalidationRect();
+        if (!dirty.IsEmpty()) {
+            display::FillRect(dirty, GetBackColor());
+        }
     }
 }
 
@@ -441,13 +526,15 @@ void window_t::ScreenEvent(window_t *sender, GUI_event_t event, void *const para
 
 // frame does something else - resend to all children
 //  MUST BE PRIVATE
-//  call nonvirtual ScreenEvent instead (contains debug output)
+//  call nonvirtual ScreenEvent instead (tracks last input event)
 void window_t::screenEvent(window_t *sender, GUI_event_t event, void *const param) {
-    WindowEvent(sender, event, param);
+    // the nonvirtual ScreenEvent already recorded last_gui_input_event,
+    // going through WindowEvent here would just redo that per node of the fan-out
+    windowEvent(sender, event, param);
 }
 
 // MUST BE PRIVATE
-// call nonvirtual WindowEvent instead (contains debug output)
+// call nonvirtual WindowEvent instead (tracks last input event)
 void window_t::windowEvent([[maybe_unused]] window_t *sender, GUI_event_t event, void *const param) {
     if (event == GUI_event_t::CLICK && parent) {
         if (flags.close_on_click == is_closed_on_click_t::yes) {
@@ -464,6 +551,7 @@ void window_t::ShiftNextTo(ShiftDir_t direction) {
 
 void window_t::Shift(ShiftDir_t direction, uint16_t distance) {
     rect = Rect16(rect, direction, distance);
+    InvalidateRectCache();
     Invalidate();
 }
 
@@ -471,18 +559,13 @@ void window_t::Shift(ShiftDir_t direction, uint16_t distance) {
 // static
 
 window_t *window_t::focused_ptr = nullptr;
-
-window_t *window_t::GetFocusedWindow() {
-    return focused_ptr;
-}
-
-void window_t::ResetFocusedWindow() {
-    focused_ptr = nullptr;
-}
+window_t *window_t::captured_snapshot = nullptr;
 
 /*****************************************************************************/
 // capture
-bool window_t::IsCaptured() const { return Screens::Access()->Get()->GetCapturedWindow() == this; }
+void window_t::UpdateCapturedWindowSnapshot() {
+    captured_snapshot = Screens::Access()->Get()->GetCapturedWindow();
+}
 
 /*****************************************************************************/
 // window_aligned_t
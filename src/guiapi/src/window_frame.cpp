@@ -315,7 +315,7 @@ void window_frame_t::screenEvent(window_t *sender, GUI_event_t event, void *para
         ptr->ScreenEvent(sender, event, param);
         ptr = ptr->GetNext();
     }
-    WindowEvent(this, event, param);
+    windowEvent(this, event, param); // bookkeeping already done by the nonvirtual ScreenEvent
 }
 
 // resend invalidation to all children
@@ -382,11 +382,20 @@ window_t *window_frame_t::GetNextEnabledSubWin(window_t *win) const {
 }
 
 window_t *window_frame_t::GetPrevEnabledSubWin(window_t *win) const {
-    window_t *tmpWin = GetPrevSubWin(win);
-    while (tmpWin && !tmpWin->IsEnabled()) {
-        tmpWin = GetPrevSubWin(tmpWin);
+    if (!win) {
+        return nullptr;
     }
-    return tmpWin;
+    if (win->GetParent() != this) {
+        return nullptr;
+    }
+    // single forward pass, restarting GetPrevSubWin for each disabled hop would be O(n^2)
+    window_t *last_enabled = nullptr;
+    for (window_t *tmpWin = first_normal; tmpWin && tmpWin != win; tmpWin = tmpWin->GetNext()) {
+        if (tmpWin->IsEnabled()) {
+            last_enabled = tmpWin;
+        }
+    }
+    return last_enabled;
 }
 
 window_t *window_frame_t::GetFirstEnabledSubWin() const {
@@ -509,6 +518,44 @@ void window_frame_t::ChildVisibilityChanged(window_t &child) {
     addInvalidationRect(child.GetRect());
 }
 
+void window_frame_t::InvalidateRectCache() {
+    window_t::InvalidateRectCache();
+
+    // children resolve their absolute rects through this frame, drop theirs too
+    // in screen_t the chain is linked normals -> dialogs -> popups, so starting
+    // at first_normal reaches every segment
+    window_t *ptr = first_normal;
+    if (!ptr) {
+        ptr = GetFirstDialog();
+    }
+    if (!ptr) {
+        ptr = GetFirstPopUp();
+    }
+    while (ptr) {
+        ptr->InvalidateRectCache();
+        ptr = ptr->GetNext();
+    }
+}
+
+void window_frame_t::UpdateAncestorBloom() {
+    window_t::UpdateAncestorBloom();
+
+    // children cache ancestor bits transitively, refresh them too
+    // in screen_t the chain is linked normals -> dialogs -> popups, so starting
+    // at first_normal reaches every segment
+    window_t *ptr = first_normal;
+    if (!ptr) {
+        ptr = GetFirstDialog();
+    }
+    if (!ptr) {
+        ptr = GetFirstPopUp();
+    }
+    while (ptr) {
+        ptr->UpdateAncestorBloom();
+        ptr = ptr->GetNext();
+    }
+}
+
 window_t *window_frame_t::getCapturedNormalWin() const {
     return captured_normal_window;
 }
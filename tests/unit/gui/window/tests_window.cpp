@@ -203,6 +203,46 @@ TEST_CASE("Window registration tests", "[window]") {
     REQUIRE(screen.GetCapturedWindow() == &screen);
 }
 
+TEST_CASE("Child cache refresh with live popup", "[window]") {
+    MockScreen screen;
+    Screens::Access()->Set(&screen); // instead of screen registration
+
+    // register a popup so the subwin chain has a tail behind the normal windows
+    window_dlg_popup_t::Show(Rect16(), string_view_utf8::MakeNULLSTR());
+    window_t *popup = screen.w_last.GetNext();
+    REQUIRE_FALSE(popup == nullptr);
+    REQUIRE(popup->GetType() == win_type_t::popup);
+
+    SECTION("ancestor bloom") {
+        window_t new_parent(nullptr, GuiDefaults::RectScreen);
+        screen.SetParent(&new_parent);
+        // refresh must reach the normal windows, not just the popup tail
+        REQUIRE(screen.w0.IsChildOf(&new_parent));
+        REQUIRE(screen.w_last.IsChildOf(&new_parent));
+        REQUIRE(popup->IsChildOf(&new_parent));
+        screen.SetParent(nullptr);
+    }
+
+    SECTION("absolute rect cache") {
+        const Rect16 unclipped = screen.w0.GetRect(); // warm the cache
+        Rect16 clipping_rect = screen.GetRect();
+        clipping_rect = Rect16::Width_t(screen.w0.GetRect().Left() + 5); // cuts w0 in half
+        screen.SetRect(clipping_rect);
+        // shrinking the screen must drop the memoized rects of the normal windows too
+        REQUIRE(screen.w0.GetRect() == unclipped.Intersection(clipping_rect));
+        REQUIRE_FALSE(screen.w0.GetRect() == unclipped);
+        screen.SetRect(GuiDefaults::RectScreen);
+    }
+
+    hal_tick = 1000; // set opened on popup
+    screen.ScreenEvent(&screen, GUI_event_t::LOOP, 0); // loop will initialize popup timeout
+    hal_tick = 10000; // timeout popup
+    screen.ScreenEvent(&screen, GUI_event_t::LOOP, 0); // loop event will unregister popup
+
+    // at the end of all sections screen must be returned to its original state
+    screen.BasicCheck();
+}
+
 TEST_CASE("Capturable test, all combinations", "[window]") {
     window_t win(nullptr, Rect16(20, 20, 10, 10));
 